@@ -1,6 +1,7 @@
 #ifndef T81_RECURSION_H
 #define T81_RECURSION_H
 
+#include <stdint.h>
 #include "t81.h"
 
 #define T81RECURSE_MAX_DEPTH 1024
@@ -15,5 +16,8 @@ TritError t81bigint_factorial_recursive(T81BigIntHandle n, T81BigIntHandle* resu
 TritError t81bigint_fibonacci_tail(T81BigIntHandle n, T81BigIntHandle* result);
 TritError t81recurse(T81BigIntHandle start, T81RecursiveCallback cb, void* context, T81BigIntHandle* result);
 void t81recursion_reset_depth();
+void t81recursion_set_threads(unsigned threads);
+void t81recursion_memo_clear(void);
+void t81recursion_memo_stats(uint64_t* hits, uint64_t* misses);
 
 #endif
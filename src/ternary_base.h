@@ -39,6 +39,12 @@ int ternary_add(TernaryHandle a, TernaryHandle b, TernaryHandle* result);
 int ternary_mul(TernaryHandle a, TernaryHandle b, TernaryHandle* result);
 int ternary_free(TernaryHandle h);
 
+/** In-place and fused forms: the accumulator keeps its buffer, growing
+    only when the result no longer fits */
+int ternary_add_inplace(TernaryHandle* acc, TernaryHandle b);             // acc += b
+int ternary_fma(TernaryHandle* acc, TernaryHandle a, TernaryHandle b);    // acc += a * b
+int ternary_reserve(TernaryHandle h, size_t digits);
+
 /** Generic to string */
 int ternary_to_string(TernaryHandle h, char** out);
 
@@ -51,10 +57,84 @@ TernaryHandle t243bigint_new_from_string(const char* str);
 int t243bigint_add(TernaryHandle a, TernaryHandle b, TernaryHandle* result);
 int t243bigint_mul(TernaryHandle a, TernaryHandle b, TernaryHandle* result);
 void t243bigint_free(TernaryHandle h);
+TernaryHandle t243bigint_new_zero(size_t capacity);
+int t243bigint_reserve(TernaryHandle h, size_t digits);
+int t243bigint_add_inplace(TernaryHandle* acc, TernaryHandle b);
+int t243bigint_fma(TernaryHandle* acc, TernaryHandle a, TernaryHandle b);
 
 // --- T729Tensor ---
+typedef enum {
+    T729_GEMM_AUTO = 0,   // widest kernel the CPU supports
+    T729_GEMM_SCALAR,
+    T729_GEMM_AVX2,
+    T729_GEMM_AVX512
+} T729GemmKind;
+
+typedef struct T729PackedOperand T729PackedOperand;
+
+/** Element-wise program: inputs are preloaded into registers 0 .. ninputs-1 */
+typedef enum {
+    T729_EW_ADD = 0,      // dst = a + b
+    T729_EW_SUB,          // dst = a - b
+    T729_EW_MUL,          // dst = a * b
+    T729_EW_DIV,          // dst = a / b
+    T729_EW_FMA,          // dst = a * b + c
+    T729_EW_MAX,
+    T729_EW_MIN,
+    T729_EW_CONST,        // dst = k
+    T729_EW_SCALE,        // dst = a * k
+    T729_EW_NEG,
+    T729_EW_ABS,
+    T729_EW_QUANTIZE,     // dst = -1, 0 or +1; |a| <= k gives 0
+    T729_EW_RELU,
+    T729_EW_LEAKY_RELU,   // slope k below zero
+    T729_EW_SIGMOID,
+    T729_EW_TANH,
+    T729_EW_GELU          // tanh approximation
+} T729ElemOp;
+
+typedef struct {
+    T729ElemOp op;
+    int dst, a, b, c;     // registers
+    float k;              // immediate
+} T729ElemInstr;
+
+#define T729_EW_MAX_REGS 16
+#define T729_EW_MAX_INPUTS 8
+#define T729_EW_MAX_RANK 16
+
+/** Trits at 2 bits each, packed along the last axis */
+typedef struct T729TritTensor T729TritTensor;
+
 TernaryHandle t729tensor_new(int rank, const int* shape);
 int t729tensor_contract(TernaryHandle a, TernaryHandle b, TernaryHandle* result);
+int t729tensor_contract_axes(TernaryHandle a, TernaryHandle b, int naxes,
+                             const int* axes_a, const int* axes_b, TernaryHandle* result);
+int t729tensor_pack_operand(TernaryHandle b, int naxes, const int* axes_b, T729PackedOperand** out);
+int t729tensor_contract_packed(TernaryHandle a, int naxes, const int* axes_a,
+                               const T729PackedOperand* pb, TernaryHandle* result);
+void t729tensor_packed_free(T729PackedOperand* pb);
+int t729tensor_slice(TernaryHandle h, int dim, int start, int end, TernaryHandle* result);    // view
+int t729tensor_transpose(TernaryHandle h, TernaryHandle* result);                             // view
+int t729tensor_permute(TernaryHandle h, const int* perm, TernaryHandle* result);              // view
+int t729tensor_reshape(TernaryHandle h, int new_rank, const int* new_shape, TernaryHandle* result);
+int t729tensor_contiguous(TernaryHandle h, TernaryHandle* result);
+int t729tensor_copy_to(TernaryHandle h, float* dst);                                          // row-major
+int t729tensor_eval(const T729ElemInstr* prog, int ninstr, const TernaryHandle* inputs,
+                    int ninputs, int out_reg, TernaryHandle* result);           // broadcasting, fused
+int t729tensor_add(TernaryHandle a, TernaryHandle b, TernaryHandle* result);
+int t729tensor_mul(TernaryHandle a, TernaryHandle b, TernaryHandle* result);
+int t729tensor_max(TernaryHandle a, TernaryHandle b, TernaryHandle* result);
+int t729tensor_fma(TernaryHandle a, TernaryHandle b, TernaryHandle c, TernaryHandle* result);  // a * b + c
+int t729tensor_map(TernaryHandle h, T729ElemOp op, float k, TernaryHandle* result);
+int t729tensor_quantize(TernaryHandle h, float threshold, TernaryHandle* result);
+int t729tensor_pack_trits(TernaryHandle h, float threshold, T729TritTensor** out);  // |x| <= threshold -> 0
+int t729tensor_unpack_trits(const T729TritTensor* p, TernaryHandle* result);
+int t729tensor_trit_matmul(const T729TritTensor* a, const T729TritTensor* b, TernaryHandle* result);  // over last axes
+int t729tensor_trit_apply(TernaryHandle x, const T729TritTensor* w, TernaryHandle* result);           // x . w^T
+void t729tensor_trits_free(T729TritTensor* p);
+int t729tensor_set_gemm_kernel(T729GemmKind kind);
+const char* t729tensor_gemm_kernel_name(void);
 void t729tensor_free(TernaryHandle h);
 
 #ifdef __cplusplus